@@ -60,7 +60,10 @@ typename VecTypeA::elem_type LMetric<2, true>::Evaluate(
     const VecTypeA& a,
     const VecTypeB& b)
 {
-  return arma::norm(a - b, 2);
+  // accu(square()) plus a scalar sqrt is cheaper than arma::norm(), which
+  // takes an extra pass to guard against overflow.  Distances of interest
+  // here are nowhere near the overflow limit of double.
+  return std::sqrt(accu(arma::square(a - b)));
 }
 
 template<>
@@ -79,10 +82,6 @@ typename VecTypeA::elem_type LMetric<3, true>::Evaluate(
     const VecTypeA& a,
     const VecTypeB& b)
 {
-  typename VecTypeA::elem_type sum = 0;
-  for (size_t i = 0; i < a.n_elem; ++i)
-    sum += std::pow(fabs(a[i] - b[i]), 3.0);
-
   return std::pow(accu(pow(arma::abs(a - b), 3.0)), 1.0 / 3.0);
 }
 
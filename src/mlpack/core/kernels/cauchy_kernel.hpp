@@ -63,8 +63,8 @@ class CauchyKernel
   template<typename VecTypeA, typename VecTypeB>
   double Evaluate(const VecTypeA& a, const VecTypeB& b)
   {
-    return 1 / (1 + (
-        std::pow(EuclideanDistance::Evaluate(a, b) / bandwidth, 2)));
+    const double scaled = EuclideanDistance::Evaluate(a, b) / bandwidth;
+    return 1 / (1 + scaled * scaled);
   }
 
   /**
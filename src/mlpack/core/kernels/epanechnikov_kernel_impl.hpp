@@ -17,6 +17,7 @@
 #include <mlpack/core/util/log.hpp>
 
 #include <mlpack/core/distances/lmetric.hpp>
+#include <mlpack/core/math/ipow.hpp>
 
 namespace mlpack {
 
@@ -35,7 +36,7 @@ inline double EpanechnikovKernel::Evaluate(const VecTypeA& a, const VecTypeB& b)
  */
 inline double EpanechnikovKernel::Normalizer(const size_t dimension)
 {
-  return 2.0 * std::pow(bandwidth, (double) dimension) *
+  return 2.0 * IPow(bandwidth, dimension) *
       std::pow(M_PI, dimension / 2.0) /
       (std::tgamma(dimension / 2.0 + 1.0) * (dimension + 2.0));
 }
@@ -45,7 +46,7 @@ inline double EpanechnikovKernel::Normalizer(const size_t dimension)
  */
 inline double EpanechnikovKernel::Evaluate(const double distance) const
 {
-  return std::max(0.0, 1 - std::pow(distance, 2.0) * inverseBandwidthSquared);
+  return std::max(0.0, 1 - distance * distance * inverseBandwidthSquared);
 }
 
 /**
@@ -17,6 +17,7 @@
 #include <mlpack/prereqs.hpp>
 #include <mlpack/core/distances/lmetric.hpp>
 #include <mlpack/core/kernels/kernel_traits.hpp>
+#include <mlpack/core/math/ipow.hpp>
 
 namespace mlpack {
 
@@ -46,7 +47,7 @@ class GaussianKernel
    */
   GaussianKernel(const double bandwidth) :
       bandwidth(bandwidth),
-      gamma(-0.5 * std::pow(bandwidth, -2.0))
+      gamma(-0.5 / (bandwidth * bandwidth))
   { }
 
   /**
@@ -77,7 +78,7 @@ class GaussianKernel
   double Evaluate(const double t) const
   {
     // The precalculation of gamma saves us a little computation time.
-    return std::exp(gamma * std::pow(t, 2.0));
+    return std::exp(gamma * t * t);
   }
 
   /**
@@ -89,7 +90,7 @@ class GaussianKernel
    *     constructor.
    */
   double Gradient(const double t) const {
-    return 2 * t * gamma * std::exp(gamma * std::pow(t, 2.0));
+    return 2 * t * gamma * std::exp(gamma * t * t);
   }
 
   /**
@@ -100,7 +101,7 @@ class GaussianKernel
    */
   double Normalizer(const size_t dimension)
   {
-    return std::pow(std::sqrt(2.0 * M_PI) * bandwidth, (double) dimension);
+    return IPow(std::sqrt(2.0 * M_PI) * bandwidth, dimension);
   }
 
   //! Get the bandwidth.
@@ -111,7 +112,7 @@ class GaussianKernel
   void Bandwidth(const double bandwidth)
   {
     this->bandwidth = bandwidth;
-    this->gamma = -0.5 * std::pow(bandwidth, -2.0);
+    this->gamma = -0.5 / (bandwidth * bandwidth);
   }
 
   //! Get the precalculated constant.
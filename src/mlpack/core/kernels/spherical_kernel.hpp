@@ -11,6 +11,7 @@
 #define MLPACK_CORE_KERNELS_SPHERICAL_KERNEL_HPP
 
 #include <mlpack/prereqs.hpp>
+#include <mlpack/core/math/ipow.hpp>
 
 namespace mlpack {
 
@@ -26,7 +27,7 @@ class SphericalKernel
    */
   SphericalKernel(const double bandwidth = 1.0) :
     bandwidth(bandwidth),
-    bandwidthSquared(std::pow(bandwidth, 2.0))
+    bandwidthSquared(bandwidth * bandwidth)
   { /* Nothing to do. */ }
 
   // Get the bandwidth.
@@ -56,7 +57,7 @@ class SphericalKernel
 
   double Normalizer(size_t dimension) const
   {
-    return std::pow(bandwidth, (double) dimension) *
+    return IPow(bandwidth, dimension) *
         std::pow(M_PI, dimension / 2.0) / std::tgamma(dimension / 2.0 + 1.0);
   }
 
@@ -0,0 +1,44 @@
+/**
+ * @file core/math/ipow.hpp
+ * @author Nikolay Apanasov
+ *
+ * Integer power utility function.
+ *
+ * mlpack is free software; you may redistribute it and/or modify it under the
+ * terms of the 3-clause BSD license.  You should have received a copy of the
+ * 3-clause BSD license along with mlpack.  If not, see
+ * http://www.opensource.org/licenses/BSD-3-Clause for more information.
+ */
+#ifndef MLPACK_CORE_MATH_IPOW_HPP
+#define MLPACK_CORE_MATH_IPOW_HPP
+
+#include <mlpack/prereqs.hpp>
+
+namespace mlpack {
+
+/**
+ * Raise a base to a non-negative integer exponent by binary exponentiation.
+ * For integer exponents, which are common in kernel normalization constants
+ * (where the exponent is the dataset dimensionality), this is cheaper than
+ * std::pow().
+ *
+ * @param base Base of the power.
+ * @param exponent Non-negative integer exponent.
+ * @return base raised to exponent.
+ */
+inline double IPow(double base, size_t exponent)
+{
+  double result = 1.0;
+  while (exponent > 0)
+  {
+    if (exponent & 1)
+      result *= base;
+    base *= base;
+    exponent >>= 1;
+  }
+  return result;
+}
+
+} // namespace mlpack
+
+#endif
@@ -15,6 +15,7 @@
 #include "ccov.hpp"
 #include "columns_to_blocks.hpp"
 #include "digamma.hpp"
+#include "ipow.hpp"
 #include "log_add.hpp"
 #include "make_alias.hpp"
 #include "multiply_slices.hpp"
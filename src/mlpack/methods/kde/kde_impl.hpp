@@ -414,32 +414,53 @@ Evaluate(MatType querySet, arma::vec& estimations)
 
     // Evaluate.
     typedef KDERules<DistanceType, KernelType, Tree> RuleType;
-    RuleType rules = RuleType(referenceTree->Dataset(),
-                              querySet,
-                              estimations,
-                              relError,
-                              absError,
-                              mcProb,
-                              initialSampleSize,
-                              mcEntryCoef,
-                              mcBreakCoef,
-                              distance,
-                              kernel,
-                              monteCarlo,
-                              false);
 
-    // Create traverser.
-    SingleTreeTraversalType<RuleType> traverser(rules);
+    // Parallelization to process more than one query at a time.  Monte Carlo
+    // estimations update the reference tree statistics, so in that case the
+    // queries are processed sequentially.
+    const bool parallel =
+        !(monteCarlo && std::is_same<KernelType, GaussianKernel>::value);
+    size_t totalScores = 0;
+    size_t totalBaseCases = 0;
 
-    // Traverse for each point.
-    for (size_t i = 0; i < querySet.n_cols; ++i)
-      traverser.Traverse(i, *referenceTree);
+    #pragma omp parallel if (parallel) \
+        reduction(+: totalScores, totalBaseCases)
+    {
+      // Each thread traverses with its own rules object (and therefore its
+      // own bookkeeping and buffers); every query point is processed by
+      // exactly one thread, so writes to the estimations vector don't
+      // conflict.
+      RuleType rules = RuleType(referenceTree->Dataset(),
+                                querySet,
+                                estimations,
+                                relError,
+                                absError,
+                                mcProb,
+                                initialSampleSize,
+                                mcEntryCoef,
+                                mcBreakCoef,
+                                distance,
+                                kernel,
+                                monteCarlo,
+                                false);
+
+      // Create traverser.
+      SingleTreeTraversalType<RuleType> traverser(rules);
+
+      // Traverse for each point.
+      #pragma omp for schedule(dynamic)
+      for (size_t i = 0; i < (size_t) querySet.n_cols; ++i)
+        traverser.Traverse(i, *referenceTree);
+
+      totalScores += rules.Scores();
+      totalBaseCases += rules.BaseCases();
+    }
 
     estimations /= referenceTree->Dataset().n_cols;
 
-    Log::Info << rules.Scores() << " node combinations were scored."
+    Log::Info << totalScores << " node combinations were scored."
               << std::endl;
-    Log::Info << rules.BaseCases() << " base cases were calculated."
+    Log::Info << totalBaseCases << " base cases were calculated."
               << std::endl;
   }
 }
@@ -571,39 +592,77 @@ Evaluate(arma::vec& estimations)
 
   // Evaluate.
   typedef KDERules<DistanceType, KernelType, Tree> RuleType;
-  RuleType rules = RuleType(referenceTree->Dataset(),
-                            referenceTree->Dataset(),
-                            estimations,
-                            relError,
-                            absError,
-                            mcProb,
-                            initialSampleSize,
-                            mcEntryCoef,
-                            mcBreakCoef,
-                            distance,
-                            kernel,
-                            monteCarlo,
-                            true);
+  size_t totalScores = 0;
+  size_t totalBaseCases = 0;
 
   if (mode == KDE_DUAL_TREE_MODE)
   {
+    RuleType rules = RuleType(referenceTree->Dataset(),
+                              referenceTree->Dataset(),
+                              estimations,
+                              relError,
+                              absError,
+                              mcProb,
+                              initialSampleSize,
+                              mcEntryCoef,
+                              mcBreakCoef,
+                              distance,
+                              kernel,
+                              monteCarlo,
+                              true);
+
     // Create traverser.
     DualTreeTraversalType<RuleType> traverser(rules);
     traverser.Traverse(*referenceTree, *referenceTree);
+
+    totalScores = rules.Scores();
+    totalBaseCases = rules.BaseCases();
   }
   else if (mode == KDE_SINGLE_TREE_MODE)
   {
-    SingleTreeTraversalType<RuleType> traverser(rules);
-    for (size_t i = 0; i < referenceTree->Dataset().n_cols; ++i)
-      traverser.Traverse(i, *referenceTree);
+    // Parallelization to process more than one point at a time.  Monte Carlo
+    // estimations update the reference tree statistics, so in that case the
+    // points are processed sequentially.
+    const bool parallel =
+        !(monteCarlo && std::is_same<KernelType, GaussianKernel>::value);
+
+    #pragma omp parallel if (parallel) \
+        reduction(+: totalScores, totalBaseCases)
+    {
+      // Each thread traverses with its own rules object (and therefore its
+      // own bookkeeping and buffers); every point is processed by exactly one
+      // thread, so writes to the estimations vector don't conflict.
+      RuleType rules = RuleType(referenceTree->Dataset(),
+                                referenceTree->Dataset(),
+                                estimations,
+                                relError,
+                                absError,
+                                mcProb,
+                                initialSampleSize,
+                                mcEntryCoef,
+                                mcBreakCoef,
+                                distance,
+                                kernel,
+                                monteCarlo,
+                                true);
+
+      SingleTreeTraversalType<RuleType> traverser(rules);
+
+      #pragma omp for schedule(dynamic)
+      for (size_t i = 0; i < (size_t) referenceTree->Dataset().n_cols; ++i)
+        traverser.Traverse(i, *referenceTree);
+
+      totalScores += rules.Scores();
+      totalBaseCases += rules.BaseCases();
+    }
   }
 
   estimations /= referenceTree->Dataset().n_cols;
   // Rearrange if necessary.
   RearrangeEstimations(*oldFromNewReferences, estimations);
 
-  Log::Info << rules.Scores() << " node combinations were scored." << std::endl;
-  Log::Info << rules.BaseCases() << " base cases were calculated." << std::endl;
+  Log::Info << totalScores << " node combinations were scored." << std::endl;
+  Log::Info << totalBaseCases << " base cases were calculated." << std::endl;
 }
 
 template<typename KernelType,
@@ -816,9 +875,11 @@ RearrangeEstimations(const std::vector<size_t>& oldFromNew,
     const size_t nQueries = oldFromNew.size();
     arma::vec rearrangedEstimations(nQueries);
 
-    // Remap vector.
+    // Remap vector.  Every old index is distinct, so the writes don't
+    // conflict and the loop can be split across threads.
+    #pragma omp parallel for
     for (size_t i = 0; i < nQueries; ++i)
-      rearrangedEstimations(oldFromNew.at(i)) = estimations(i);
+      rearrangedEstimations(oldFromNew[i]) = estimations(i);
 
     estimations = std::move(rearrangedEstimations);
   }
@@ -25,6 +25,18 @@ template<typename DistanceType, typename KernelType, typename TreeType>
 class KDERules
 {
  public:
+  //! Convenience typedef for the type of matrix the tree holds.  This allows
+  //! reference and query sets with any element type (e.g. arma::fmat for
+  //! single-precision storage); densities are always accumulated in double
+  //! precision.
+  typedef typename TreeType::Mat MatType;
+
+  //! The element type of the point sets.
+  typedef typename MatType::elem_type ElemType;
+
+  //! Column vector type corresponding to MatType.
+  typedef arma::Col<ElemType> VecType;
+
   /**
    * Construct KDERules.
    *
@@ -45,8 +57,8 @@ class KDERules
    * @param sameSet True if query and reference sets are the same
    *                (monochromatic evaluation).
    */
-  KDERules(const arma::mat& referenceSet,
-           const arma::mat& querySet,
+  KDERules(const MatType& referenceSet,
+           const MatType& querySet,
            arma::vec& densities,
            const double relError,
            const double absError,
@@ -102,17 +114,35 @@ class KDERules
                         const size_t referenceIndex) const;
 
   //! Evaluate kernel value of 2 points.
-  double EvaluateKernel(const arma::vec& query,
-                        const arma::vec& reference) const;
+  double EvaluateKernel(const VecType& query,
+                        const VecType& reference) const;
 
   //! Calculate depth alpha for some node.
   double CalculateAlpha(TreeType* node);
 
+  //! Get the two-sided normal quantile z for significance level alpha,
+  //! caching the last computed value.
+  double CalculateZ(const double alpha);
+
+  /**
+   * Sample kernel values between a query point and random descendants of a
+   * reference node until the Monte Carlo confidence condition is met, and
+   * store their mean in meanSample.
+   *
+   * @return False if exact computation of the node is expected to be cheaper
+   *     than sampling (in which case meanSample is not meaningful).
+   */
+  bool MonteCarloSample(const size_t queryIndex,
+                        TreeType& referenceNode,
+                        const bool alreadyDidRefPoint0,
+                        const double z,
+                        double& meanSample);
+
   //! The reference set.
-  const arma::mat& referenceSet;
+  const MatType& referenceSet;
 
   //! The query set.
-  const arma::mat& querySet;
+  const MatType& querySet;
 
   //! Density values.
   arma::vec& densities;
@@ -139,6 +169,10 @@ class KDERules
   //! is the limit before Monte Carlo estimation recurses.
   const double mcBreakCoef;
 
+  //! Minimum amount of node descendants for the Monte Carlo path to be
+  //! considered; hoisted out of Score() since it never changes.
+  const double mcEntryThreshold;
+
   //! Instantiated distance metric.
   DistanceType& distance;
 
@@ -154,6 +188,14 @@ class KDERules
   //! Accumulated not used error tolerance for each query point.
   arma::vec accumError;
 
+  //! Buffer for Monte Carlo samples.  It is reused across Score() calls so
+  //! that the traversal hot loop does not reallocate it constantly.
+  arma::vec mcSampleBuffer;
+
+  //! Buffer for the Monte Carlo mean of each query node descendant.  It is
+  //! reused across Score() calls as well.
+  arma::vec mcMeansBuffer;
+
   //! Whether reference and query sets are the same.
   const bool sameSet;
 
@@ -170,6 +212,13 @@ class KDERules
   //! The last reference index.
   size_t lastReferenceIndex;
 
+  //! The significance level for which lastZ was computed.
+  double lastAlpha;
+
+  //! Cached two-sided normal quantile for lastAlpha.  Quantile() is
+  //! expensive, and the same alpha is typically scored many times in a row.
+  double lastZ;
+
   //! Traversal information.
   TraversalInfoType traversalInfo;
 
@@ -23,8 +23,8 @@ namespace mlpack {
 
 template<typename DistanceType, typename KernelType, typename TreeType>
 KDERules<DistanceType, KernelType, TreeType>::KDERules(
-    const arma::mat& referenceSet,
-    const arma::mat& querySet,
+    const typename TreeType::Mat& referenceSet,
+    const typename TreeType::Mat& querySet,
     arma::vec& densities,
     const double relError,
     const double absError,
@@ -45,6 +45,7 @@ KDERules<DistanceType, KernelType, TreeType>::KDERules(
     initialSampleSize(initialSampleSize),
     mcAccessCoef(mcAccessCoef),
     mcBreakCoef(mcBreakCoef),
+    mcEntryThreshold(mcAccessCoef * initialSampleSize),
     distance(distance),
     kernel(kernel),
     monteCarlo(monteCarlo),
@@ -52,6 +53,8 @@ KDERules<DistanceType, KernelType, TreeType>::KDERules(
     absErrorTol(absError / referenceSet.n_cols),
     lastQueryIndex(querySet.n_cols),
     lastReferenceIndex(referenceSet.n_cols),
+    lastAlpha(-1.0),
+    lastZ(0.0),
     baseCases(0),
     scores(0)
 {
@@ -79,14 +82,16 @@ double KDERules<DistanceType, KernelType, TreeType>::BaseCase(
   if ((lastQueryIndex == queryIndex) && (lastReferenceIndex == referenceIndex))
     return 0.0;
 
-  // Calculations.
-  const double d = distance.Evaluate(querySet.col(queryIndex),
-                                     referenceSet.col(referenceIndex));
+  // Calculations.  unsafe_col() yields a contiguous alias of the column
+  // instead of a subview proxy, which keeps the distance computation on the
+  // fast dense-vector path.
+  const double d = distance.Evaluate(querySet.unsafe_col(queryIndex),
+                                     referenceSet.unsafe_col(referenceIndex));
   const double kernelValue = kernel.Evaluate(d);
-  densities(queryIndex) += kernelValue;
+  densities[queryIndex] += kernelValue;
 
   // Update accumulated relative error tolerance for single-tree pruning.
-  accumError(queryIndex) += 2 * relError * kernelValue;
+  accumError[queryIndex] += 2 * relError * kernelValue;
 
   ++baseCases;
   lastQueryIndex = queryIndex;
@@ -101,12 +106,49 @@ inline double KDERules<DistanceType, KernelType, TreeType>::
 Score(const size_t queryIndex, TreeType& referenceNode)
 {
   // Auxiliary variables.
-  const arma::vec& queryPoint = querySet.unsafe_col(queryIndex);
+  const VecType& queryPoint = querySet.unsafe_col(queryIndex);
   const size_t refNumDesc = referenceNode.NumDescendants();
   double score, minDistance, maxDistance, depthAlpha;
   // Calculations are not duplicated.
   bool alreadyDidRefPoint0 = false;
 
+  // Fast path for single-point reference nodes: bounding the node costs two
+  // kernel evaluations plus a range distance, while evaluating its only point
+  // exactly costs one of each, so compute it directly and prune.
+  if (refNumDesc == 1)
+  {
+    const size_t refIndex = referenceNode.Descendant(0);
+
+    // Check whether the point was already taken into account.
+    const bool refPointDone =
+        (TreeTraits<TreeType>::FirstPointIsCentroid &&
+         lastQueryIndex == queryIndex &&
+         traversalInfo.LastReferenceNode() != NULL &&
+         lastReferenceIndex == referenceNode.Point(0)) ||
+        (TreeTraits<TreeType>::HasSelfChildren &&
+         referenceNode.Parent() != NULL &&
+         referenceNode.Parent()->Point(0) == referenceNode.Point(0));
+
+    if (!refPointDone && !(sameSet && queryIndex == refIndex))
+    {
+      densities[queryIndex] += EvaluateKernel(queryIndex, refIndex);
+
+      // The contribution is exact, so the unused absolute error tolerance
+      // becomes available to the rest of the traversal.
+      accumError[queryIndex] += 2 * absErrorTol;
+    }
+
+    // The node is exactly computed, so reclaim its not used alpha for Monte
+    // Carlo estimations.
+    if (monteCarlo && kernelIsGaussian)
+      accumMCAlpha[queryIndex] += CalculateAlpha(&referenceNode);
+
+    ++scores;
+    traversalInfo.LastReferenceNode() = &referenceNode;
+    traversalInfo.LastScore() = DBL_MAX;
+    return DBL_MAX;
+  }
+
   // Calculate alpha if Monte Carlo is available.
   if (monteCarlo && kernelIsGaussian)
     depthAlpha = CalculateAlpha(&referenceNode);
@@ -128,7 +170,7 @@ Score(const size_t queryIndex, TreeType& referenceNode)
   else
   {
     // All Calculations are new.
-    const Range r = referenceNode.RangeDistance(queryPoint);
+    const RangeType<ElemType> r = referenceNode.RangeDistance(queryPoint);
     minDistance = r.Lo();
     maxDistance = r.Hi();
 
@@ -150,107 +192,59 @@ Score(const size_t queryIndex, TreeType& referenceNode)
   const double relErrorTol = relError * minKernel;
   const double errorTolerance = absErrorTol + relErrorTol;
 
-  // We relax the bound for pruning by accumError(queryIndex), so that if there
+  // Effective number of descendants to account for; when the first reference
+  // point was already handled we have one point less to estimate.  Computing
+  // this once as integer arithmetic removes the alreadyDidRefPoint0 branches
+  // from every use below.
+  const size_t effNumDesc = refNumDesc - (alreadyDidRefPoint0 ? 1 : 0);
+
+  // We relax the bound for pruning by accumError[queryIndex], so that if there
   // is any leftover error tolerance from the rest of the traversal, we can use
   // it here to prune more.
-  double pointAccumErrorTol;
-  if (alreadyDidRefPoint0)
-    pointAccumErrorTol = accumError(queryIndex) / (refNumDesc - 1);
-  else
-    pointAccumErrorTol = accumError(queryIndex) / refNumDesc;
+  const double pointAccumErrorTol = accumError[queryIndex] / effNumDesc;
 
   if (bound <= 2 * errorTolerance + pointAccumErrorTol)
   {
     // Estimate kernel value.
     const double kernelValue = (maxKernel + minKernel) / 2.0;
 
-    if (alreadyDidRefPoint0)
-      densities(queryIndex) += (refNumDesc - 1) * kernelValue;
-    else
-      densities(queryIndex) += refNumDesc * kernelValue;
+    densities[queryIndex] += effNumDesc * kernelValue;
 
     // Don't explore this tree branch.
     score = DBL_MAX;
 
     // Subtract used error tolerance or add extra available tolerace from this
     // prune.
-    if (alreadyDidRefPoint0)
-      accumError(queryIndex) -= (refNumDesc - 1) * (bound - 2 * errorTolerance);
-    else
-      accumError(queryIndex) -= refNumDesc * (bound - 2 * errorTolerance);
+    accumError[queryIndex] -= effNumDesc * (bound - 2 * errorTolerance);
 
     // Store not used alpha for Monte Carlo.
     if (kernelIsGaussian && monteCarlo)
-      accumMCAlpha(queryIndex) += depthAlpha;
+      accumMCAlpha[queryIndex] += depthAlpha;
   }
   else if (monteCarlo &&
-           refNumDesc >= mcAccessCoef * initialSampleSize &&
+           refNumDesc >= mcEntryThreshold &&
            kernelIsGaussian)
   {
     // Monte Carlo probabilistic estimation.
     // Calculate z using accumulated alpha if possible.
-    const double alpha = depthAlpha + accumMCAlpha(queryIndex);
-    const double z = std::abs(Quantile(alpha / 2.0));
-
-    // Auxiliary variables.
-    arma::vec sample;
-    size_t m = initialSampleSize;
-    double meanSample = 0;
-    bool useMonteCarloPredictions = true;
-
-    // Resample as long as confidence is not high enough.
-    while (m > 0)
-    {
-      const size_t oldSize = sample.size();
-      const size_t newSize = oldSize + m;
-
-      // Don't use probabilistic estimation if this is going to take a similar
-      // amount of computations to the exact calculation.
-      if (newSize >= mcBreakCoef * refNumDesc)
-      {
-        useMonteCarloPredictions = false;
-        break;
-      }
+    const double alpha = depthAlpha + accumMCAlpha[queryIndex];
+    const double z = CalculateZ(alpha);
 
-      // Increase the sample size.
-      sample.resize(newSize);
-      for (size_t i = 0; i < m; ++i)
-      {
-        // Sample and evaluate random points from the reference node.
-        size_t randomPoint;
-        if (alreadyDidRefPoint0)
-          randomPoint = RandInt(1, refNumDesc);
-        else
-          randomPoint = RandInt(0, refNumDesc);
-
-        sample(oldSize + i) =
-            EvaluateKernel(queryIndex, referenceNode.Descendant(randomPoint));
-      }
-      meanSample = arma::mean(sample);
-      const double stddev = arma::stddev(sample);
-      const double mThreshBase =
-          z * stddev * (1 + relError) / (relError * meanSample);
-      const size_t mThresh = std::ceil(mThreshBase * mThreshBase);
-
-      if (sample.size() < mThresh)
-        m = mThresh - sample.size();
-      else
-        m = 0;
-    }
+    // Sample kernel values until the confidence condition is met.
+    double meanSample;
+    const bool useMonteCarloPredictions = MonteCarloSample(queryIndex,
+        referenceNode, alreadyDidRefPoint0, z, meanSample);
 
     if (useMonteCarloPredictions)
     {
       // Confidence is high enough so we can use Monte Carlo estimation.
-      if (alreadyDidRefPoint0)
-        densities(queryIndex) += (refNumDesc - 1) * meanSample;
-      else
-        densities(queryIndex) += refNumDesc * meanSample;
+      densities[queryIndex] += effNumDesc * meanSample;
 
       // Prune.
       score = DBL_MAX;
 
       // Accumulated alpha has been used.
-      accumMCAlpha(queryIndex) = 0;
+      accumMCAlpha[queryIndex] = 0;
     }
     else
     {
@@ -260,7 +254,7 @@ Score(const size_t queryIndex, TreeType& referenceNode)
       if (referenceNode.IsLeaf())
       {
         // Reclaim not used alpha since the node will be exactly computed.
-        accumMCAlpha(queryIndex) += depthAlpha;
+        accumMCAlpha[queryIndex] += depthAlpha;
       }
     }
   }
@@ -271,17 +265,12 @@ Score(const size_t queryIndex, TreeType& referenceNode)
 
     // Add accumulated unused absolute error tolerance.
     if (referenceNode.IsLeaf())
-    {
-      if (alreadyDidRefPoint0)
-        accumError(queryIndex) += (refNumDesc - 1) * 2 * absErrorTol;
-      else
-        accumError(queryIndex) += refNumDesc * 2 * absErrorTol;
-    }
+      accumError[queryIndex] += effNumDesc * 2 * absErrorTol;
 
     // If node is going to be exactly computed, reclaim not used alpha for
     // Monte Carlo estimations.
     if (kernelIsGaussian && monteCarlo && referenceNode.IsLeaf())
-      accumMCAlpha(queryIndex) += depthAlpha;
+      accumMCAlpha[queryIndex] += depthAlpha;
   }
 
   ++scores;
@@ -345,7 +334,7 @@ Score(TreeType& queryNode, TreeType& referenceNode)
   else
   {
     // All calculations are new.
-    const Range r = queryNode.RangeDistance(referenceNode);
+    const RangeType<ElemType> r = queryNode.RangeDistance(referenceNode);
     minDistance = r.Lo();
     maxDistance = r.Hi();
   }
@@ -374,9 +363,9 @@ Score(TreeType& queryNode, TreeType& referenceNode)
     for (size_t i = 0; i < queryNode.NumDescendants(); ++i)
     {
       if (alreadyDidRefPoint0 && i == 0)
-        densities(queryNode.Descendant(i)) += (refNumDesc - 1) * kernelValue;
+        densities[queryNode.Descendant(i)] += (refNumDesc - 1) * kernelValue;
       else
-        densities(queryNode.Descendant(i)) += refNumDesc * kernelValue;
+        densities[queryNode.Descendant(i)] += refNumDesc * kernelValue;
     }
 
     // Prune.
@@ -391,73 +380,36 @@ Score(TreeType& queryNode, TreeType& referenceNode)
       queryStat.AccumAlpha() += depthAlpha;
   }
   else if (monteCarlo &&
-           refNumDesc >= mcAccessCoef * initialSampleSize &&
+           refNumDesc >= mcEntryThreshold &&
            kernelIsGaussian)
   {
     // Monte Carlo probabilistic estimation.
     // Calculate z using accumulated alpha if possible.
     const double alpha = depthAlpha + queryStat.AccumAlpha();
-    const double z = std::abs(Quantile(alpha / 2));
+    const double z = CalculateZ(alpha);
 
-    // Auxiliary variables.
-    arma::vec sample;
-    arma::vec means = zeros(queryNode.NumDescendants());
-    size_t m;
-    double meanSample = 0;
-    bool useMonteCarloPredictions = true;
+    // Get the means buffer ready.  It is reused across Score() calls, so it
+    // only grows when a larger query node than ever before is scored.
+    if (mcMeansBuffer.n_elem < queryNode.NumDescendants())
+      mcMeansBuffer.set_size(queryNode.NumDescendants());
 
-    // Pick a sample for every query node.
+    // Pick a sample for every query node descendant.
+    bool useMonteCarloPredictions = true;
     for (size_t i = 0; i < queryNode.NumDescendants(); ++i)
     {
       const size_t queryIndex = queryNode.Descendant(i);
-      sample.clear();
-      m = initialSampleSize;
-
-      // Resample as long as confidence is not high enough.
-      while (m > 0)
+      double meanSample;
+      if (MonteCarloSample(queryIndex, referenceNode, alreadyDidRefPoint0, z,
+          meanSample))
       {
-        const size_t oldSize = sample.size();
-        const size_t newSize = oldSize + m;
-
-        // Don't use probabilistic estimation if this is going to take a similar
-        // amount of computations to the exact calculation.
-        if (newSize >= mcBreakCoef * refNumDesc)
-        {
-          useMonteCarloPredictions = false;
-          break;
-        }
-
-        // Increase the sample size.
-        sample.resize(newSize);
-        for (size_t i = 0; i < m; ++i)
-        {
-          // Sample and evaluate random points from the reference node.
-          size_t randomPoint;
-          if (alreadyDidRefPoint0)
-            randomPoint = RandInt(1, refNumDesc);
-          else
-            randomPoint = RandInt(0, refNumDesc);
-
-          sample(oldSize + i) =
-              EvaluateKernel(queryIndex, referenceNode.Descendant(randomPoint));
-        }
-        meanSample = arma::mean(sample);
-        const double stddev = arma::stddev(sample);
-        const double mThreshBase =
-            z * stddev * (1 + relError) / (relError * meanSample);
-        const size_t mThresh = std::ceil(mThreshBase * mThreshBase);
-
-        if (sample.size() < mThresh)
-          m = mThresh - sample.size();
-        else
-          m = 0;
+        // Store mean for the i_th query node descendant point.
+        mcMeansBuffer[i] = meanSample;
       }
-
-      // Store mean for the i_th query node descendant point.
-      if (useMonteCarloPredictions)
-        means(i) = meanSample;
       else
+      {
+        useMonteCarloPredictions = false;
         break;
+      }
     }
 
     if (useMonteCarloPredictions)
@@ -466,9 +418,15 @@ Score(TreeType& queryNode, TreeType& referenceNode)
       for (size_t i = 0; i < queryNode.NumDescendants(); ++i)
       {
         if (alreadyDidRefPoint0 && i == 0)
-          densities(queryNode.Descendant(i)) += (refNumDesc - 1) * means(i);
+        {
+          densities[queryNode.Descendant(i)] +=
+              (refNumDesc - 1) * mcMeansBuffer[i];
+        }
         else
-          densities(queryNode.Descendant(i)) += refNumDesc * means(i);
+        {
+          densities[queryNode.Descendant(i)] +=
+              refNumDesc * mcMeansBuffer[i];
+        }
       }
 
       // Prune.
@@ -534,7 +492,7 @@ EvaluateKernel(const size_t queryIndex,
 
 template<typename DistanceType, typename KernelType, typename TreeType>
 inline mlpack_force_inline double KDERules<DistanceType, KernelType, TreeType>::
-EvaluateKernel(const arma::vec& query, const arma::vec& reference) const
+EvaluateKernel(const VecType& query, const VecType& reference) const
 {
   return kernel.Evaluate(distance.Evaluate(query, reference));
 }
@@ -568,6 +526,100 @@ CalculateAlpha(TreeType* node)
   return stat.MCAlpha();
 }
 
+template<typename DistanceType, typename KernelType, typename TreeType>
+inline mlpack_force_inline double KDERules<DistanceType, KernelType, TreeType>::
+CalculateZ(const double alpha)
+{
+  // The same significance level is typically seen many times in a row, e.g.
+  // when a reference node is scored against many query points in sequence, so
+  // the last quantile computation is cached.
+  if (alpha != lastAlpha)
+  {
+    lastZ = std::abs(Quantile(alpha / 2.0));
+    lastAlpha = alpha;
+  }
+  return lastZ;
+}
+
+template<typename DistanceType, typename KernelType, typename TreeType>
+inline bool KDERules<DistanceType, KernelType, TreeType>::
+MonteCarloSample(const size_t queryIndex,
+                 TreeType& referenceNode,
+                 const bool alreadyDidRefPoint0,
+                 const double z,
+                 double& meanSample)
+{
+  const size_t refNumDesc = referenceNode.NumDescendants();
+  // Lower sampling bound; skips the first reference point when it has already
+  // been taken into account.
+  const size_t lowerBound = alreadyDidRefPoint0 ? 1 : 0;
+  size_t sampleSize = 0;
+  size_t m = initialSampleSize;
+  meanSample = 0;
+
+  // Resample as long as confidence is not high enough.
+  while (m > 0)
+  {
+    const size_t oldSize = sampleSize;
+    const size_t newSize = oldSize + m;
+
+    // Don't use probabilistic estimation if this is going to take a similar
+    // amount of computations to the exact calculation.
+    if (newSize >= mcBreakCoef * refNumDesc)
+      return false;
+
+    // Increase the sample size.  The buffer is reused across calls, so it
+    // only grows when a larger sample than ever before is needed.
+    if (mcSampleBuffer.n_elem < newSize)
+    {
+      mcSampleBuffer.resize(std::max(newSize,
+          (size_t) (2 * mcSampleBuffer.n_elem)));
+    }
+    sampleSize = newSize;
+    for (size_t i = 0; i < m; ++i)
+    {
+      // Sample random points from the reference node.
+      const size_t randomPoint = RandInt(lowerBound, refNumDesc);
+
+      if constexpr (kernelIsGaussian)
+      {
+        // Store the distance only; the kernel is evaluated over the whole
+        // batch below.
+        mcSampleBuffer[oldSize + i] = distance.Evaluate(
+            querySet.unsafe_col(queryIndex),
+            referenceSet.unsafe_col(referenceNode.Descendant(randomPoint)));
+      }
+      else
+      {
+        mcSampleBuffer[oldSize + i] = EvaluateKernel(queryIndex,
+            referenceNode.Descendant(randomPoint));
+      }
+    }
+
+    if constexpr (kernelIsGaussian)
+    {
+      // Evaluate the batch of sampled distances in a single vectorized sweep
+      // instead of calling std::exp() once per sample.
+      mcSampleBuffer.subvec(oldSize, sampleSize - 1) = arma::exp(
+          kernel.Gamma() *
+          arma::square(mcSampleBuffer.subvec(oldSize, sampleSize - 1)));
+    }
+    meanSample = arma::mean(mcSampleBuffer.subvec(0, sampleSize - 1));
+    const double stddev =
+        arma::stddev(mcSampleBuffer.subvec(0, sampleSize - 1));
+    const double mThreshBase =
+        z * stddev * (1 + relError) / (relError * meanSample);
+    const size_t mThresh = std::ceil(mThreshBase * mThreshBase);
+
+    if (sampleSize < mThresh)
+      m = mThresh - sampleSize;
+    else
+      m = 0;
+  }
+
+  return true;
+}
+
 //! Clean rules base case.
 template<typename TreeType>
 inline mlpack_force_inline
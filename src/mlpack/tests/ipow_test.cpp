@@ -0,0 +1,47 @@
+/**
+ * @file tests/ipow_test.cpp
+ * @author Nikolay Apanasov
+ *
+ * Test the IPow() integer power function.
+ *
+ * mlpack is free software; you may redistribute it and/or modify it under the
+ * terms of the 3-clause BSD license.  You should have received a copy of the
+ * 3-clause BSD license along with mlpack.  If not, see
+ * http://www.opensource.org/licenses/BSD-3-Clause for more information.
+ */
+#include <mlpack/core.hpp>
+
+#include "catch.hpp"
+#include "test_catch_tools.hpp"
+
+using namespace mlpack;
+
+/**
+ * Test IPow() against std::pow() for a range of bases and exponents.
+ */
+TEST_CASE("IPowMatchesStdPow", "[IPowTest]")
+{
+  const double bases[] = { 0.1, 0.5, 1.0, 1.7, 2.0, 3.14159, 10.0 };
+
+  for (const double base : bases)
+    for (size_t exponent = 0; exponent <= 12; ++exponent)
+      REQUIRE(IPow(base, exponent) ==
+          Approx(std::pow(base, (double) exponent)).epsilon(1e-10));
+}
+
+/**
+ * Test the edge cases of IPow().
+ */
+TEST_CASE("IPowEdgeCases", "[IPowTest]")
+{
+  // Anything raised to the zeroth power is one.
+  REQUIRE(IPow(0.0, 0) == Approx(1.0));
+  REQUIRE(IPow(5.0, 0) == Approx(1.0));
+
+  // Zero raised to any positive power is zero.
+  REQUIRE(IPow(0.0, 3) == Approx(0.0).margin(1e-15));
+
+  // Negative bases keep the sign for odd exponents.
+  REQUIRE(IPow(-2.0, 3) == Approx(-8.0));
+  REQUIRE(IPow(-2.0, 4) == Approx(16.0));
+}
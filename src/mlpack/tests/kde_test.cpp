@@ -179,6 +179,70 @@ TEST_CASE("GaussianSingleKDEBruteForceTest", "[KDETest]")
     REQUIRE(bfEstimations[i] == Approx(treeEstimations[i]).epsilon(relError));
 }
 
+/**
+ * Test dual-tree implementation results with single-precision point sets
+ * against brute force results.
+ */
+TEST_CASE("GaussianKDEFloatTest", "[KDETest]")
+{
+  arma::fmat reference = arma::randu<arma::fmat>(2, 200);
+  arma::fmat query = arma::randu<arma::fmat>(2, 60);
+  arma::vec bfEstimations = arma::vec(query.n_cols, arma::fill::zeros);
+  arma::vec treeEstimations = arma::vec(query.n_cols, arma::fill::zeros);
+  const double kernelBandwidth = 0.3;
+  const double relError = 0.05;
+
+  // Brute force KDE (done in double precision).
+  GaussianKernel kernel(kernelBandwidth);
+  BruteForceKDE<GaussianKernel>(arma::conv_to<arma::mat>::from(reference),
+                                arma::conv_to<arma::mat>::from(query),
+                                bfEstimations,
+                                kernel);
+
+  // Optimized KDE.
+  EuclideanDistance distance;
+  KDE<GaussianKernel, EuclideanDistance, arma::fmat, KDTree> kde(
+      relError, 0.0, kernel, KDEMode::KDE_DUAL_TREE_MODE, distance);
+  kde.Train(reference);
+  kde.Evaluate(query, treeEstimations);
+
+  // Check whether results are equal.
+  for (size_t i = 0; i < query.n_cols; ++i)
+    REQUIRE(bfEstimations[i] == Approx(treeEstimations[i]).epsilon(relError));
+}
+
+/**
+ * Test single-tree implementation results with single-precision point sets
+ * against brute force results using a cover-tree.
+ */
+TEST_CASE("GaussianCoverSingleKDEFloatTest", "[KDETest]")
+{
+  arma::fmat reference = arma::randu<arma::fmat>(2, 300);
+  arma::fmat query = arma::randu<arma::fmat>(2, 100);
+  arma::vec bfEstimations = arma::vec(query.n_cols, arma::fill::zeros);
+  arma::vec treeEstimations = arma::vec(query.n_cols, arma::fill::zeros);
+  const double kernelBandwidth = 1.1;
+  const double relError = 0.08;
+
+  // Brute force KDE (done in double precision).
+  GaussianKernel kernel(kernelBandwidth);
+  BruteForceKDE<GaussianKernel>(arma::conv_to<arma::mat>::from(reference),
+                                arma::conv_to<arma::mat>::from(query),
+                                bfEstimations,
+                                kernel);
+
+  // Optimized KDE.
+  EuclideanDistance distance;
+  KDE<GaussianKernel, EuclideanDistance, arma::fmat, StandardCoverTree>
+      kde(relError, 0.0, kernel, KDEMode::KDE_SINGLE_TREE_MODE, distance);
+  kde.Train(reference);
+  kde.Evaluate(query, treeEstimations);
+
+  // Check whether results are equal.
+  for (size_t i = 0; i < query.n_cols; ++i)
+    REQUIRE(bfEstimations[i] == Approx(treeEstimations[i]).epsilon(relError));
+}
+
 /**
  * Test single-tree implementation results against brute force results using
  * a cover-tree and Epanechnikov kernel.